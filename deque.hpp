@@ -1,7 +1,9 @@
 #pragma once
 #include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 template <typename T, typename Allocator = std::allocator<T>>
@@ -21,6 +23,8 @@ class Deque {
 
   Deque() = default;
 
+  explicit Deque(const Allocator& alloc);
+
   Deque(const Deque& deq);
 
   explicit Deque(size_t count, const Allocator& alloc = Allocator());
@@ -93,6 +97,24 @@ class Deque {
 
   void pop_front();
 
+  // Move the first (pop_front_n) or last (pop_back_n, last element first)
+  // count <= size() elements to out_it and remove them. If writing to out_it
+  // throws, elements already moved out of the current block stay in the deque
+  // in a moved-from state.
+  template <typename OutputIt>
+  OutputIt pop_front_n(size_t count, OutputIt out_it);
+  template <typename OutputIt>
+  OutputIt pop_back_n(size_t count, OutputIt out_it);
+
+  // Appends all elements to deq and leaves *this empty. Block pointers are
+  // handed over only while the source front and the destination back sit at
+  // the same offset inside a block; otherwise, with equal allocators and a
+  // nothrow move, the smaller side is moved and the storage is swapped.
+  void drain_into(Deque<T, Allocator>& deq);
+
+  Deque split(iterator split_it);
+  void concat(Deque<T, Allocator>&& deq);
+
   size_t new_data_size();
 
   T& top();
@@ -120,7 +142,6 @@ class Deque {
 
   Deque(const Deque& deq, const Allocator& alloc);
 
-  bool fulled_front() const;
   bool fulled_back() const;
 
   static constexpr size_t kBucketSize = 60;
@@ -133,6 +154,11 @@ class Deque {
   BaseIterator<false> end_;
 
   void allocate_data(const BaseIterator<false>& iterator);
+  void prepare_back();
+  void transfer_front(Deque<T, Allocator>& deq, size_t count);
+  void splice_front_block(Deque<T, Allocator>& deq);
+  void reserve_front(size_t count);
+  void prepend_from(Deque<T, Allocator>& deq) noexcept;
 };
 
 template <typename T, typename Allocator>
@@ -195,7 +221,7 @@ class Deque<T, Allocator>::BaseIterator {
 template <typename T, typename Allocator>
 template <bool IsConst>
 Deque<T, Allocator>::BaseIterator<IsConst>::BaseIterator(BaseIterator&& iter)
-    : arr_(iter.arr_), ind_j_(iter.ind_j_) {
+    : ind_j_(iter.ind_j_), arr_(iter.arr_) {
   iter.arr_ = nullptr;
   iter.ind_j_ = 0;
 }
@@ -400,6 +426,9 @@ Deque<T, Allocator>::Deque(const Deque& deq, const Allocator& alloc)
   }
 }
 
+template <typename T, typename Allocator>
+Deque<T, Allocator>::Deque(const Allocator& alloc) : allocator_(alloc) {}
+
 template <typename T, typename Allocator>
 Deque<T, Allocator>::Deque(const Deque<T, Allocator>& deq)
     : Deque(deq, alloc_traits::select_on_container_copy_construction(
@@ -444,8 +473,8 @@ Deque<T, Allocator>::Deque(size_t count, const Allocator& alloc)
 }
 
 template <typename T, typename Allocator>
-Deque<T, Allocator>::Deque(Deque&& other) {
-  move_swap(other);
+Deque<T, Allocator>::Deque(Deque&& other) : allocator_(other.allocator_) {
+  swap(other);
 }
 
 template <typename T, typename Allocator>
@@ -522,26 +551,12 @@ Deque<T, Allocator>& Deque<T, Allocator>::operator=(Deque&& deq) {
   if (alloc_traits::propagate_on_container_move_assignment::value ||
       allocator_ == deq.allocator_) {
     swap(deq);
-    allocator_ = deq.allocator_;
   } else {
-    auto alloc = deq.allocator_;
-    Deque new_deq;
-    new_deq.swap(deq);
-    deq.allocator_ = alloc;
-    try {
-      for (auto iter = new_deq.begin_; iter != new_deq.end_; ++iter) {
-        emplace_back(std::move(*iter));
-      }
-    } catch (...) {
-      for (auto iter = begin_; iter != end_; ++iter) {
-        alloc_traits::destroy(allocator_, iter.operator->());
-      }
-      for (size_t ind = 0; ind < data_.size(); ++ind) {
-        alloc_traits::deallocate(allocator_, data_[ind], kBucketSize);
-      }
-      data_ = {};
-      throw;
+    Deque new_deq(allocator_);
+    for (auto iter = deq.begin_; iter != deq.end_; ++iter) {
+      new_deq.emplace_back(std::move(*iter));
     }
+    swap(new_deq);
   }
   return *this;
 }
@@ -582,11 +597,6 @@ const T& Deque<T, Allocator>::at(size_t ind) const {
   return *(begin_ + ind);
 }
 
-template <typename T, typename Allocator>
-bool Deque<T, Allocator>::fulled_front() const {
-  return begin_.get_ind() == 0 && *(begin_.get_arr() - 1) == nullptr;
-}
-
 template <typename T, typename Allocator>
 bool Deque<T, Allocator>::fulled_back() const {
   return end_.get_ind() == 0 && *(end_.get_arr()) == nullptr;
@@ -638,15 +648,20 @@ void Deque<T, Allocator>::push_back(T&& value) {
 }
 
 template <typename T, typename Allocator>
-template <typename... Args>
-void Deque<T, Allocator>::emplace_back(Args&&... args) {
+void Deque<T, Allocator>::prepare_back() {
   if (data_.empty() ||
-      end_.get_ind() == 0 && end_.get_arr() == data_.data() + data_.size()) {
+      (end_.get_ind() == 0 && end_.get_arr() == data_.data() + data_.size())) {
     reserve();
     allocate_data(end_);
   } else if (fulled_back()) {
     allocate_data(end_);
   }
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+void Deque<T, Allocator>::emplace_back(Args&&... args) {
+  prepare_back();
   alloc_traits::construct(allocator_, *end_.get_arr() + end_.get_ind(),
                           std::forward<Args>(args)...);
   ++end_;
@@ -667,18 +682,16 @@ template <typename T, typename Allocator>
 template <typename... Args>
 void Deque<T, Allocator>::emplace_front(Args&&... args) {
   if (data_.empty() ||
-      begin_.get_ind() == 0 && begin_.get_arr() == data_.data()) {
+      (begin_.get_ind() == 0 && begin_.get_arr() == data_.data())) {
     reserve();
-    --begin_;
-    allocate_data(begin_);
-  } else if (fulled_front()) {
-    --begin_;
-    allocate_data(begin_);
-  } else {
-    --begin_;
   }
-  alloc_traits::construct(allocator_, *begin_.get_arr() + begin_.get_ind(),
+  iterator new_begin = begin_ - 1;
+  if (*new_begin.get_arr() == nullptr) {
+    allocate_data(new_begin);
+  }
+  alloc_traits::construct(allocator_, new_begin.operator->(),
                           std::forward<Args>(args)...);
+  begin_ = new_begin;
   ++size_;
 }
 
@@ -696,6 +709,209 @@ void Deque<T, Allocator>::pop_front() {
   --size_;
 }
 
+template <typename T, typename Allocator>
+template <typename OutputIt>
+OutputIt Deque<T, Allocator>::pop_front_n(size_t count, OutputIt out_it) {
+  assert(count <= size_);
+  while (count > 0) {
+    size_t chunk = std::min(count, kBucketSize - begin_.get_ind());
+    T* first = begin_.operator->();
+    out_it = std::move(first, first + chunk, out_it);
+    for (size_t ind = 0; ind < chunk; ++ind) {
+      alloc_traits::destroy(allocator_, first + ind);
+    }
+    begin_ += static_cast<int>(chunk);
+    size_ -= chunk;
+    count -= chunk;
+  }
+  return out_it;
+}
+
+template <typename T, typename Allocator>
+template <typename OutputIt>
+OutputIt Deque<T, Allocator>::pop_back_n(size_t count, OutputIt out_it) {
+  assert(count <= size_);
+  while (count > 0) {
+    iterator last_it = end_ - 1;
+    size_t chunk = std::min(count, last_it.get_ind() + 1);
+    T* last = last_it.operator->() + 1;
+    out_it = std::move(std::make_reverse_iterator(last),
+                       std::make_reverse_iterator(last - chunk), out_it);
+    for (size_t ind = 1; ind <= chunk; ++ind) {
+      alloc_traits::destroy(allocator_, last - ind);
+    }
+    end_ -= static_cast<int>(chunk);
+    size_ -= chunk;
+    count -= chunk;
+  }
+  return out_it;
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::transfer_front(Deque<T, Allocator>& deq,
+                                         size_t count) {
+  T* src = begin_.operator->();
+  T* dst = deq.end_.operator->();
+  auto commit = [&](size_t moved) {
+    for (size_t ind = 0; ind < moved; ++ind) {
+      alloc_traits::destroy(allocator_, src + ind);
+    }
+    begin_ += static_cast<int>(moved);
+    size_ -= moved;
+    deq.end_ += static_cast<int>(moved);
+    deq.size_ += moved;
+  };
+  size_t moved = 0;
+  try {
+    for (; moved < count; ++moved) {
+      alloc_traits::construct(deq.allocator_, dst + moved,
+                              std::move(src[moved]));
+    }
+  } catch (...) {
+    commit(moved);
+    throw;
+  }
+  commit(moved);
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::splice_front_block(Deque<T, Allocator>& deq) {
+  if (deq.end_.get_arr() == deq.data_.data() + deq.data_.size()) {
+    deq.reserve();
+  }
+  std::swap(*deq.end_.get_arr(), *begin_.get_arr());
+  begin_ += static_cast<int>(kBucketSize);
+  size_ -= kBucketSize;
+  deq.end_ += static_cast<int>(kBucketSize);
+  deq.size_ += kBucketSize;
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::reserve_front(size_t count) {
+  if (count <= begin_.get_ind()) {
+    return;
+  }
+  size_t blocks = (count - begin_.get_ind() + kBucketSize - 1) / kBucketSize;
+  while (static_cast<size_t>(begin_.get_arr() - data_.data()) < blocks) {
+    reserve();
+  }
+  for (T** slot = begin_.get_arr() - blocks; slot != begin_.get_arr();
+       ++slot) {
+    if (*slot == nullptr) {
+      *slot = alloc_traits::allocate(allocator_, kBucketSize);
+    }
+  }
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::prepend_from(Deque<T, Allocator>& deq) noexcept {
+  while (!deq.empty()) {
+    iterator last_it = deq.end_ - 1;
+    size_t chunk = std::min({deq.size_, last_it.get_ind() + 1,
+                             begin_.get_ind() == 0 ? kBucketSize
+                                                   : begin_.get_ind()});
+    T* src = last_it.operator->() + 1 - chunk;
+    iterator new_begin = begin_ - static_cast<int>(chunk);
+    T* dst = new_begin.operator->();
+    for (size_t ind = 0; ind < chunk; ++ind) {
+      alloc_traits::construct(allocator_, dst + ind, std::move(src[ind]));
+      alloc_traits::destroy(deq.allocator_, src + ind);
+    }
+    begin_ = new_begin;
+    size_ += chunk;
+    deq.end_ -= static_cast<int>(chunk);
+    deq.size_ -= chunk;
+  }
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::drain_into(Deque<T, Allocator>& deq) {
+  if (this == &deq || empty()) {
+    return;
+  }
+  bool same_alloc = allocator_ == deq.allocator_;
+  if (same_alloc && deq.empty()) {
+    swap(deq);
+    return;
+  }
+  if (same_alloc && std::is_nothrow_move_constructible_v<T> &&
+      begin_.get_ind() != deq.end_.get_ind() && deq.size_ < size_) {
+    reserve_front(deq.size_);
+    prepend_from(deq);
+    swap(deq);
+    return;
+  }
+  while (!empty()) {
+    if (same_alloc && size_ >= kBucketSize && begin_.get_ind() == 0 &&
+        deq.end_.get_ind() == 0) {
+      splice_front_block(deq);
+      continue;
+    }
+    deq.prepare_back();
+    transfer_front(deq, std::min({size_, kBucketSize - begin_.get_ind(),
+                                  kBucketSize - deq.end_.get_ind()}));
+  }
+}
+
+template <typename T, typename Allocator>
+Deque<T, Allocator> Deque<T, Allocator>::split(iterator split_it) {
+  Deque suffix(allocator_);
+  if (split_it == end_) {
+    return suffix;
+  }
+  size_t suffix_size = end_ - split_it;
+  size_t blocks = end_.get_arr() - split_it.get_arr();
+  suffix.data_.resize(blocks + 1);
+  T** first_slot = split_it.get_arr();
+  bool shared_block = split_it.get_ind() != 0 && split_it != begin_;
+  if (shared_block) {
+    size_t head_count =
+        std::min(suffix_size, kBucketSize - split_it.get_ind());
+    suffix.allocate_data({0, suffix.data_.data()});
+    T* src = split_it.operator->();
+    T* dst = suffix.data_[0] + split_it.get_ind();
+    size_t moved = 0;
+    try {
+      for (; moved < head_count; ++moved) {
+        alloc_traits::construct(suffix.allocator_, dst + moved,
+                                std::move(src[moved]));
+      }
+    } catch (...) {
+      for (size_t ind = 0; ind < moved; ++ind) {
+        alloc_traits::destroy(suffix.allocator_, dst + ind);
+      }
+      throw;
+    }
+    for (size_t ind = 0; ind < head_count; ++ind) {
+      alloc_traits::destroy(allocator_, src + ind);
+    }
+    ++first_slot;
+  }
+  T** data_end = data_.data() + data_.size();
+  for (T** slot = first_slot; slot <= end_.get_arr() && slot != data_end;
+       ++slot) {
+    suffix.data_[slot - split_it.get_arr()] = *slot;
+    *slot = nullptr;
+  }
+  suffix.begin_ = {split_it.get_ind(), suffix.data_.data()};
+  suffix.end_ = {end_.get_ind(), suffix.data_.data() + blocks};
+  suffix.size_ = suffix_size;
+  size_ -= suffix_size;
+  end_ = shared_block ? split_it : iterator(0, split_it.get_arr());
+  if (empty()) {
+    begin_ = end_;
+  }
+  return suffix;
+}
+
+template <typename T, typename Allocator>
+void Deque<T, Allocator>::concat(Deque<T, Allocator>&& deq) {
+  if (this == &deq) {
+    return;
+  }
+  deq.drain_into(*this);
+}
+
 template <typename T, typename Allocator>
 T& Deque<T, Allocator>::top() {
   return *rbegin();
@@ -727,18 +943,16 @@ void Deque<T, Allocator>::emplace(iterator insert_it, Args&&... args) {
     emplace_back(std::forward<Args>(args)...);
     return;
   }
-  T last_element = top();
-  for (iterator iter = end() - 1; iter != insert_it; --iter) {
-    *iter = *(iter - 1);
-  }
-  *insert_it = T(std::forward<Args>(args)...);
-  push_back(std::move(last_element));
+  T value(std::forward<Args>(args)...);
+  size_t insert_ind = insert_it - begin_;
+  emplace_back(std::move(top()));
+  insert_it = begin_ + insert_ind;
+  std::move_backward(insert_it, end_ - 2, end_ - 1);
+  *insert_it = std::move(value);
 }
 
 template <typename T, typename Allocator>
 void Deque<T, Allocator>::erase(iterator erase_it) {
-  for (iterator iter = erase_it; iter != end(); ++iter) {
-    *iter = *(iter + 1);
-  }
+  std::move(erase_it + 1, end_, erase_it);
   pop_back();
 }
@@ -0,0 +1,836 @@
+// Differential fuzz and stress harness for Deque and StaticDeque.
+//
+// Random operation sequences run against std::deque as an oracle. Every
+// block goes through a stateful counting allocator that can fail on a chosen
+// allocation and tags blocks with their owner, and element constructors can
+// be told to throw. The constructors' catch blocks, split, and the strong
+// guarantee of the single-element operations are checked separately.
+// StaticDeque is additionally checked at compile time. The reported ops/s
+// comes from a separate Deque<int> pass without the oracle.
+//
+//   g++ -std=c++20 -O2 deque_fuzz.cpp -o deque_fuzz
+//   ./deque_fuzz [seed] [ops]
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <iterator>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "deque.hpp"
+#include "static_deque.hpp"
+
+namespace {
+
+[[noreturn]] void fail(const char* what, unsigned seed) {
+  std::fprintf(stderr, "FAILED (seed %u): %s\n", seed, what);
+  std::exit(1);
+}
+
+struct AllocState {
+  long allocations = 0;
+  long live_blocks = 0;
+  long fail_at = -1;
+  bool foreign_free = false;
+};
+
+AllocState default_state;
+
+template <typename T>
+class CountingAllocator {
+ public:
+  using value_type = T;
+
+  CountingAllocator() : state_(&default_state) {}
+  explicit CountingAllocator(AllocState* state) : state_(state) {}
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>& other)
+      : state_(other.state()) {}
+
+  T* allocate(size_t count) {
+    if (state_->allocations++ == state_->fail_at) {
+      throw std::bad_alloc();
+    }
+    auto* raw = static_cast<char*>(::operator new(kHeader + count * sizeof(T)));
+    *reinterpret_cast<AllocState**>(raw) = state_;
+    ++state_->live_blocks;
+    return reinterpret_cast<T*>(raw + kHeader);
+  }
+
+  void deallocate(T* ptr, size_t /*count*/) {
+    if (ptr == nullptr) {
+      return;
+    }
+    char* raw = reinterpret_cast<char*>(ptr) - kHeader;
+    if (*reinterpret_cast<AllocState**>(raw) != state_) {
+      state_->foreign_free = true;
+    }
+    --(*reinterpret_cast<AllocState**>(raw))->live_blocks;
+    ::operator delete(raw);
+  }
+
+  AllocState* state() const { return state_; }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>& other) const {
+    return state_ == other.state();
+  }
+  template <typename U>
+  bool operator!=(const CountingAllocator<U>& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  static constexpr size_t kHeader = alignof(std::max_align_t);
+  AllocState* state_;
+};
+
+struct ElementError {};
+
+struct ElementState {
+  static inline long live = 0;
+  static inline long throw_countdown = -1;
+
+  static void maybe_throw() {
+    if (throw_countdown > 0 && --throw_countdown == 0) {
+      throw ElementError();
+    }
+  }
+};
+
+template <bool NothrowMove>
+class Tracked {
+ public:
+  Tracked() : Tracked(0) {}
+  Tracked(int value) : value_(value) {
+    ElementState::maybe_throw();
+    ++ElementState::live;
+  }
+  Tracked(const Tracked& other) : value_(other.value_) {
+    ElementState::maybe_throw();
+    ++ElementState::live;
+  }
+  Tracked(Tracked&& other) noexcept(NothrowMove) : value_(other.value_) {
+    if constexpr (!NothrowMove) {
+      ElementState::maybe_throw();
+    }
+    ++ElementState::live;
+  }
+  Tracked& operator=(const Tracked& other) = default;
+  Tracked& operator=(Tracked&& other) noexcept = default;
+  ~Tracked() { --ElementState::live; }
+
+  int value() const { return value_; }
+
+ private:
+  int value_;
+};
+
+template <typename Elem>
+using TestDeque = Deque<Elem, CountingAllocator<Elem>>;
+
+template <typename Elem>
+bool same(const TestDeque<Elem>& deq, const std::deque<int>& oracle) {
+  if (deq.size() != oracle.size()) {
+    return false;
+  }
+  size_t ind = 0;
+  for (auto iter = deq.begin(); iter != deq.end(); ++iter, ++ind) {
+    if (iter->value() != oracle[ind] || deq[ind].value() != oracle[ind]) {
+      return false;
+    }
+  }
+  return ind == oracle.size();
+}
+
+template <typename Elem>
+long run_differential(unsigned seed, long ops) {
+  std::mt19937 rng(seed);
+  AllocState state_a;
+  AllocState state_b;
+  {
+    CountingAllocator<Elem> alloc_a(&state_a);
+    CountingAllocator<Elem> alloc_b(&state_b);
+    TestDeque<Elem> deq(alloc_a);
+    TestDeque<Elem> same_alloc(alloc_a);
+    TestDeque<Elem> foreign(alloc_b);
+    std::deque<int> oracle;
+    std::deque<int> same_oracle;
+    std::deque<int> foreign_oracle;
+    std::vector<Elem> out;
+    int next = 0;
+
+    for (long op = 0; op < ops; ++op) {
+      size_t size = oracle.size();
+      unsigned kind = rng() % 20;
+      if (size > 4000 && kind < 8) {
+        kind = 11;
+      }
+      bool use_foreign = rng() % 2 == 0;
+      TestDeque<Elem>& other = use_foreign ? foreign : same_alloc;
+      std::deque<int>& other_oracle =
+          use_foreign ? foreign_oracle : same_oracle;
+      int value = next++;
+      switch (kind) {
+        case 0:
+          deq.push_back(Elem(value));
+          oracle.push_back(value);
+          break;
+        case 1:
+          deq.push_front(Elem(value));
+          oracle.push_front(value);
+          break;
+        case 2:
+          deq.emplace_back(value);
+          oracle.push_back(value);
+          break;
+        case 3:
+          deq.emplace_front(value);
+          oracle.push_front(value);
+          break;
+        case 4:
+          if (size > 0) {
+            deq.pop_back();
+            oracle.pop_back();
+          }
+          break;
+        case 5:
+          if (size > 0) {
+            deq.pop_front();
+            oracle.pop_front();
+          }
+          break;
+        case 6: {
+          size_t pos = rng() % (size + 1);
+          deq.insert(deq.begin() + pos, Elem(value));
+          oracle.insert(oracle.begin() + pos, value);
+          break;
+        }
+        case 7: {
+          size_t pos = rng() % (size + 1);
+          deq.emplace(deq.begin() + pos, value);
+          oracle.insert(oracle.begin() + pos, value);
+          break;
+        }
+        case 8:
+          if (size > 0) {
+            size_t pos = rng() % size;
+            deq.erase(deq.begin() + pos);
+            oracle.erase(oracle.begin() + pos);
+          }
+          break;
+        case 9: {
+          TestDeque<Elem> copy(deq);
+          if (!same(copy, oracle)) {
+            fail("copy constructor", seed);
+          }
+          other = copy;
+          other_oracle = oracle;
+          break;
+        }
+        case 10: {
+          TestDeque<Elem> moved(std::move(deq));
+          deq = std::move(other);
+          other = std::move(moved);
+          std::swap(oracle, other_oracle);
+          if (use_foreign) {
+            foreign = TestDeque<Elem>(alloc_b);
+            foreign_oracle.clear();
+          }
+          break;
+        }
+        case 11: {
+          size_t count = rng() % (size + 1);
+          out.clear();
+          deq.pop_front_n(count, std::back_inserter(out));
+          for (size_t ind = 0; ind < count; ++ind) {
+            if (out[ind].value() != oracle.front()) {
+              fail("pop_front_n order", seed);
+            }
+            oracle.pop_front();
+          }
+          break;
+        }
+        case 12: {
+          size_t count = rng() % (size + 1);
+          out.clear();
+          deq.pop_back_n(count, std::back_inserter(out));
+          for (size_t ind = 0; ind < count; ++ind) {
+            if (out[ind].value() != oracle.back()) {
+              fail("pop_back_n order", seed);
+            }
+            oracle.pop_back();
+          }
+          break;
+        }
+        case 13:
+          if (rng() % 2 == 0) {
+            deq.drain_into(other);
+            other_oracle.insert(other_oracle.end(), oracle.begin(),
+                                oracle.end());
+            oracle.clear();
+          } else {
+            other.drain_into(deq);
+            oracle.insert(oracle.end(), other_oracle.begin(),
+                          other_oracle.end());
+            other_oracle.clear();
+          }
+          break;
+        case 14: {
+          size_t pos = rng() % (size + 1);
+          TestDeque<Elem> suffix = deq.split(deq.begin() + pos);
+          std::deque<int> suffix_oracle(oracle.begin() + pos, oracle.end());
+          oracle.erase(oracle.begin() + pos, oracle.end());
+          if (!same(suffix, suffix_oracle)) {
+            fail("split suffix", seed);
+          }
+          suffix.push_front(Elem(value));
+          suffix_oracle.push_front(value);
+          deq.concat(std::move(suffix));
+          oracle.insert(oracle.end(), suffix_oracle.begin(),
+                        suffix_oracle.end());
+          break;
+        }
+        case 15:
+          deq.concat(std::move(other));
+          oracle.insert(oracle.end(), other_oracle.begin(),
+                        other_oracle.end());
+          other_oracle.clear();
+          if (!other.empty()) {
+            fail("concat source not emptied", seed);
+          }
+          break;
+        case 16:
+          if (size > 0) {
+            size_t pos = rng() % size;
+            if (deq.at(pos).value() != oracle[pos] ||
+                deq.top().value() != oracle.back()) {
+              fail("element access", seed);
+            }
+          }
+          try {
+            deq.at(size);
+            fail("at() past the end did not throw", seed);
+          } catch (const std::out_of_range&) {
+          }
+          break;
+        default:
+          if (!use_foreign) {
+            deq.swap(other);
+            std::swap(oracle, other_oracle);
+          } else {
+            other.push_back(Elem(value));
+            other_oracle.push_back(value);
+          }
+          break;
+      }
+      if (!same(deq, oracle) || !same(other, other_oracle)) {
+        fail(("mismatch after operation kind " + std::to_string(kind)).c_str(),
+             seed);
+      }
+    }
+  }
+  if (state_a.live_blocks != 0 || state_b.live_blocks != 0) {
+    fail("leaked blocks", seed);
+  }
+  if (state_a.foreign_free || state_b.foreign_free) {
+    fail("block freed by a different allocator", seed);
+  }
+  return ops;
+}
+
+// Schedules either one of the next `allocations` allocations to fail or one
+// of the next `constructions` element constructors to throw.
+void arm(std::mt19937& rng, AllocState& state, long allocations,
+         long constructions) {
+  if (rng() % 2 == 0) {
+    state.allocations = 0;
+    state.fail_at = rng() % allocations;
+  } else {
+    ElementState::throw_countdown = 1 + rng() % constructions;
+  }
+}
+
+void disarm(AllocState& state) {
+  state.fail_at = -1;
+  ElementState::throw_countdown = -1;
+}
+
+// Runs make() with a failure armed and checks that nothing leaks either way.
+template <typename Make>
+long inject(std::mt19937& rng, AllocState& state, unsigned seed, Make make,
+            const char* what) {
+  long blocks = state.live_blocks;
+  long live = ElementState::live;
+  arm(rng, state, 8, 200);
+  try {
+    make();
+  } catch (const std::bad_alloc&) {
+  } catch (const ElementError&) {
+  }
+  disarm(state);
+  if (state.live_blocks != blocks || ElementState::live != live) {
+    fail(what, seed);
+  }
+  return 1;
+}
+
+template <typename Elem>
+long run_exception_checks(unsigned seed, long rounds) {
+  std::mt19937 rng(seed);
+  AllocState state;
+  CountingAllocator<Elem> alloc(&state);
+  long scenarios = 0;
+  for (long round = 0; round < rounds; ++round) {
+    size_t count = rng() % 300;
+    scenarios += inject(
+        rng, state, seed,
+        [&] { TestDeque<Elem> deq(count, Elem(7), alloc); },
+        "Deque(count, value, alloc) leaked");
+    scenarios += inject(
+        rng, state, seed, [&] { TestDeque<Elem> deq(count, alloc); },
+        "Deque(count, alloc) leaked");
+    scenarios += inject(
+        rng, state, seed,
+        [&] {
+          TestDeque<Elem> deq({Elem(1), Elem(2), Elem(3), Elem(4), Elem(5),
+                               Elem(6), Elem(7), Elem(8)},
+                              alloc);
+        },
+        "Deque(initializer_list, alloc) leaked");
+
+    TestDeque<Elem> source(alloc);
+    std::deque<int> oracle;
+    for (size_t ind = 0; ind < count; ++ind) {
+      source.push_back(Elem(static_cast<int>(ind)));
+      oracle.push_back(static_cast<int>(ind));
+    }
+    scenarios += inject(
+        rng, state, seed, [&] { TestDeque<Elem> copy(source); },
+        "copy constructor leaked");
+    scenarios += inject(
+        rng, state, seed,
+        [&] {
+          TestDeque<Elem> target(alloc);
+          target.push_back(Elem(-1));
+          try {
+            target = source;
+          } catch (...) {
+            if (target.size() != 1 || target[0].value() != -1) {
+              fail("copy assignment broke the strong guarantee", seed);
+            }
+            throw;
+          }
+        },
+        "copy assignment leaked");
+
+    size_t pos = rng() % (oracle.size() + 1);
+    unsigned kind = rng() % 3;
+    arm(rng, state, 2, 2);
+    try {
+      if (kind == 0) {
+        source.push_back(Elem(-2));
+        oracle.push_back(-2);
+      } else if (kind == 1) {
+        source.emplace_front(-2);
+        oracle.push_front(-2);
+      } else {
+        source.insert(source.begin() + pos, Elem(-2));
+        oracle.insert(oracle.begin() + pos, -2);
+      }
+    } catch (const std::bad_alloc&) {
+    } catch (const ElementError&) {
+    }
+    disarm(state);
+    ++scenarios;
+    if (!same(source, oracle)) {
+      fail("single-element insertion broke the strong guarantee", seed);
+    }
+
+    {
+      long blocks = state.live_blocks;
+      long live = ElementState::live;
+      {
+        TestDeque<Elem> deq(source);
+        size_t split_pos = rng() % (oracle.size() + 1);
+        arm(rng, state, 2, 80);
+        bool failed = false;
+        try {
+          TestDeque<Elem> suffix = deq.split(deq.begin() + split_pos);
+          disarm(state);
+          if (!same(deq, std::deque<int>(oracle.begin(),
+                                         oracle.begin() + split_pos)) ||
+              !same(suffix, std::deque<int>(oracle.begin() + split_pos,
+                                            oracle.end()))) {
+            fail("split result", seed);
+          }
+        } catch (const std::bad_alloc&) {
+          failed = true;
+        } catch (const ElementError&) {
+          failed = true;
+        }
+        disarm(state);
+        if (failed && !same(deq, oracle)) {
+          fail("split changed the deque on failure", seed);
+        }
+      }
+      ++scenarios;
+      if (state.live_blocks != blocks || ElementState::live != live) {
+        fail("split leaked", seed);
+      }
+    }
+
+    AllocState other_state;
+    {
+      TestDeque<Elem> other{CountingAllocator<Elem>(&other_state)};
+      other.push_back(Elem(-3));
+      size_t total = source.size() + other.size();
+      ElementState::throw_countdown = 1 + rng() % 200;
+      try {
+        source.drain_into(other);
+      } catch (const ElementError&) {
+      }
+      ElementState::throw_countdown = -1;
+      if (source.size() + other.size() != total) {
+        fail("drain_into lost elements on a throwing move", seed);
+      }
+    }
+    if (other_state.live_blocks != 0) {
+      fail("drain_into leaked", seed);
+    }
+  }
+  if (state.live_blocks != 0 || ElementState::live != 0) {
+    fail("exception checks leaked", seed);
+  }
+  return scenarios;
+}
+
+constexpr bool static_deque_constexpr_checks() {
+  StaticDeque<int, 6> deq{1, 2, 3};
+  deq.push_front(0);
+  deq.emplace_back(4);
+  deq.pop_front();
+  deq.pop_back();
+  deq.push_front(10);
+  deq.emplace_front(11);
+  deq.pop_back();
+  deq.insert(deq.begin() + 1, 7);
+  deq.emplace(deq.begin() + 3, 8);
+  deq.erase(deq.begin());
+  // 7 10 8 1 2, stored across the wrap point of the ring.
+  if (deq.size() != 5 || deq[0] != 7 || deq[2] != 8 || deq.top() != 2) {
+    return false;
+  }
+
+  StaticDeque<int, 6> copy(deq);
+  copy.pop_front();
+  StaticDeque<int, 6> moved(std::move(copy));
+  StaticDeque<int, 6> assigned;
+  assigned = deq;
+  assigned = std::move(moved);
+  if (assigned.size() != 4 || assigned[0] != 10 || deq.size() != 5) {
+    return false;
+  }
+
+  deq.swap(assigned);
+  if (deq.size() != 4 || deq[0] != 10 || assigned.size() != 5 ||
+      assigned[0] != 7) {
+    return false;
+  }
+
+  int sum = 0;
+  for (auto iter = assigned.rbegin(); iter != assigned.rend(); ++iter) {
+    sum = sum * 10 + *iter;
+  }
+  return sum == 218 * 100 + 107;
+}
+
+static_assert(static_deque_constexpr_checks());
+
+constexpr StaticDeque<int, 4> kConstantDeque{1, 2, 3};
+static_assert(kConstantDeque.size() == 3 && kConstantDeque[2] == 3);
+
+template <typename Elem, size_t N>
+bool same(const StaticDeque<Elem, N>& deq, const std::deque<int>& oracle) {
+  if (deq.size() != oracle.size()) {
+    return false;
+  }
+  size_t ind = 0;
+  for (auto iter = deq.begin(); iter != deq.end(); ++iter, ++ind) {
+    if (iter->value() != oracle[ind] || deq[ind].value() != oracle[ind]) {
+      return false;
+    }
+  }
+  return ind == oracle.size();
+}
+
+long run_static_differential(unsigned seed, long ops) {
+  constexpr size_t kCapacity = 37;
+  using Elem = Tracked<true>;
+  using Static = StaticDeque<Elem, kCapacity>;
+  std::mt19937 rng(seed);
+  long live = ElementState::live;
+  {
+    Static deq;
+    Static other;
+    std::deque<int> oracle;
+    std::deque<int> other_oracle;
+    std::vector<Elem> out;
+    int next = 0;
+
+    for (long op = 0; op < ops; ++op) {
+      size_t size = oracle.size();
+      bool has_room = size < kCapacity;
+      unsigned kind = rng() % 14;
+      int value = next++;
+      switch (kind) {
+        case 0:
+          if (has_room) {
+            deq.push_back(Elem(value));
+            oracle.push_back(value);
+          }
+          break;
+        case 1:
+          if (has_room) {
+            deq.emplace_front(value);
+            oracle.push_front(value);
+          }
+          break;
+        case 2:
+          if (size > 0) {
+            deq.pop_back();
+            oracle.pop_back();
+          }
+          break;
+        case 3:
+          if (size > 0) {
+            deq.pop_front();
+            oracle.pop_front();
+          }
+          break;
+        case 4:
+          if (has_room) {
+            size_t pos = rng() % (size + 1);
+            deq.insert(deq.begin() + pos, Elem(value));
+            oracle.insert(oracle.begin() + pos, value);
+          }
+          break;
+        case 5:
+          if (has_room) {
+            size_t pos = rng() % (size + 1);
+            deq.emplace(deq.begin() + pos, value);
+            oracle.insert(oracle.begin() + pos, value);
+          }
+          break;
+        case 6:
+          if (size > 0) {
+            size_t pos = rng() % size;
+            deq.erase(deq.begin() + pos);
+            oracle.erase(oracle.begin() + pos);
+          }
+          break;
+        case 7: {
+          Static copy(deq);
+          other = copy;
+          other_oracle = oracle;
+          break;
+        }
+        case 8: {
+          Static moved(std::move(deq));
+          deq = std::move(other);
+          other = std::move(moved);
+          std::swap(oracle, other_oracle);
+          break;
+        }
+        case 9:
+          deq.swap(other);
+          std::swap(oracle, other_oracle);
+          break;
+        case 10: {
+          size_t count = rng() % (size + 1);
+          out.clear();
+          if (rng() % 2 == 0) {
+            deq.pop_front_n(count, std::back_inserter(out));
+            for (size_t ind = 0; ind < count; ++ind, oracle.pop_front()) {
+              if (out[ind].value() != oracle.front()) {
+                fail("StaticDeque pop_front_n order", seed);
+              }
+            }
+          } else {
+            deq.pop_back_n(count, std::back_inserter(out));
+            for (size_t ind = 0; ind < count; ++ind, oracle.pop_back()) {
+              if (out[ind].value() != oracle.back()) {
+                fail("StaticDeque pop_back_n order", seed);
+              }
+            }
+          }
+          break;
+        }
+        case 11:
+          while (oracle.size() < kCapacity) {
+            deq.push_back(Elem(value));
+            oracle.push_back(value);
+          }
+          try {
+            if (rng() % 2 == 0) {
+              deq.push_back(Elem(value));
+            } else {
+              deq.emplace_front(value);
+            }
+            fail("StaticDeque push past capacity did not throw", seed);
+          } catch (const std::length_error&) {
+          }
+          break;
+        case 12:
+          try {
+            deq.at(size);
+            fail("StaticDeque at() past the end did not throw", seed);
+          } catch (const std::out_of_range&) {
+          }
+          break;
+        default:
+          if (size > kCapacity / 2) {
+            deq.pop_front_n(size / 2, std::back_inserter(out));
+            oracle.erase(oracle.begin(), oracle.begin() + size / 2);
+          }
+          break;
+      }
+      if (!same(deq, oracle) || !same(other, other_oracle)) {
+        fail(("StaticDeque mismatch after operation kind " +
+              std::to_string(kind))
+                 .c_str(),
+             seed);
+      }
+    }
+  }
+  if (ElementState::live != live) {
+    fail("StaticDeque leaked elements", seed);
+  }
+  return ops;
+}
+
+template <typename Elem>
+void run(const char* name, unsigned seed, long ops) {
+  long done = run_differential<Elem>(seed, ops);
+  long scenarios = run_exception_checks<Elem>(seed, ops / 1000 + 1);
+  std::printf("%s: %ld ops checked, %ld injected failures\n", name, done,
+              scenarios);
+}
+
+struct BenchOp {
+  unsigned kind;
+  unsigned arg;
+};
+
+// Times the same operation mix on Deque<int> alone: the sequence is generated
+// up front and there is no oracle or comparison inside the timed loop.
+void run_benchmark(unsigned seed, long ops) {
+  std::mt19937 rng(seed);
+  std::vector<BenchOp> plan(ops);
+  for (auto& op : plan) {
+    op = {static_cast<unsigned>(rng() % 16), static_cast<unsigned>(rng())};
+  }
+  Deque<int> deq;
+  Deque<int> other;
+  std::vector<int> out;
+  long checksum = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (long ind = 0; ind < ops; ++ind) {
+    unsigned kind = plan[ind].kind;
+    unsigned arg = plan[ind].arg;
+    size_t size = deq.size();
+    if (size > 4000 && kind < 8) {
+      kind = 10;
+    }
+    switch (kind) {
+      case 0:
+        deq.push_back(static_cast<int>(arg));
+        break;
+      case 1:
+        deq.push_front(static_cast<int>(arg));
+        break;
+      case 2:
+        deq.emplace_back(static_cast<int>(arg));
+        break;
+      case 3:
+        deq.emplace_front(static_cast<int>(arg));
+        break;
+      case 4:
+        if (size > 0) {
+          checksum += deq.top();
+          deq.pop_back();
+        }
+        break;
+      case 5:
+        if (size > 0) {
+          checksum += deq[0];
+          deq.pop_front();
+        }
+        break;
+      case 6:
+        deq.insert(deq.begin() + arg % (size + 1), static_cast<int>(arg));
+        break;
+      case 7:
+        if (size > 0) {
+          deq.erase(deq.begin() + arg % size);
+        }
+        break;
+      case 8: {
+        Deque<int> copy(deq);
+        other = std::move(copy);
+        break;
+      }
+      case 9:
+        deq.swap(other);
+        break;
+      case 10:
+        out.clear();
+        deq.pop_front_n(arg % (size + 1), std::back_inserter(out));
+        checksum += static_cast<long>(out.size());
+        break;
+      case 11:
+        out.clear();
+        deq.pop_back_n(arg % (size + 1), std::back_inserter(out));
+        checksum += static_cast<long>(out.size());
+        break;
+      case 12:
+        other.drain_into(deq);
+        break;
+      case 13: {
+        Deque<int> suffix = deq.split(deq.begin() + arg % (size + 1));
+        deq.concat(std::move(suffix));
+        break;
+      }
+      default:
+        if (size > 0) {
+          checksum += deq.at(arg % size);
+        }
+        break;
+    }
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  std::printf("Deque<int>: %ld ops in %.3f s (%.0f ops/s), checksum %ld\n",
+              ops, seconds, ops / seconds, checksum + static_cast<long>(
+                                                          deq.size()));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  unsigned seed = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1;
+  long ops = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 200000;
+  run<Tracked<true>>("nothrow move", seed, ops);
+  run<Tracked<false>>("throwing move", seed, ops);
+  std::printf("StaticDeque: %ld ops checked\n",
+              run_static_differential(seed, ops));
+  run_benchmark(seed, ops);
+  std::printf("seed %u: OK\n", seed);
+  return 0;
+}
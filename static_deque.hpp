@@ -0,0 +1,534 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+template <typename T, size_t N>
+class StaticDeque {
+  static_assert(N > 0, "StaticDeque capacity must be positive");
+
+ private:
+  template <bool IsConst>
+  class BaseIterator;
+
+ public:
+  using iterator = BaseIterator<false>;
+  using const_iterator = BaseIterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  constexpr StaticDeque() = default;
+
+  constexpr StaticDeque(const StaticDeque& deq);
+
+  constexpr explicit StaticDeque(size_t count);
+
+  constexpr StaticDeque(size_t count, const T& value);
+
+  constexpr StaticDeque(StaticDeque&& other) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+
+  constexpr StaticDeque(std::initializer_list<T> init);
+
+  constexpr StaticDeque& operator=(const StaticDeque& deq);
+  constexpr StaticDeque& operator=(StaticDeque&& deq) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+
+  constexpr ~StaticDeque();
+
+  constexpr iterator begin() { return {0, this}; }
+
+  constexpr iterator end() { return {size_, this}; }
+
+  constexpr const_iterator cbegin() const { return {0, this}; }
+
+  constexpr const_iterator begin() const { return cbegin(); }
+
+  constexpr const_iterator cend() const { return {size_, this}; }
+
+  constexpr const_iterator end() const { return cend(); }
+
+  constexpr reverse_iterator rend() { return reverse_iterator(begin()); }
+
+  constexpr reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+  constexpr const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  }
+
+  constexpr const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  }
+
+  constexpr const_reverse_iterator crend() const {
+    return const_reverse_iterator(begin());
+  }
+
+  constexpr const_reverse_iterator crbegin() const {
+    return const_reverse_iterator(end());
+  }
+
+  constexpr size_t size() const { return size_; }
+
+  constexpr bool empty() const { return size_ == 0; }
+
+  constexpr bool full() const { return size_ == N; }
+
+  static constexpr size_t capacity() { return N; }
+
+  constexpr void push_back(const T& value);
+  constexpr void push_back(T&& value);
+
+  template <typename... Args>
+  constexpr void emplace_back(Args&&... args);
+
+  constexpr void pop_back();
+
+  constexpr void push_front(const T& value);
+  constexpr void push_front(T&& value);
+
+  template <typename... Args>
+  constexpr void emplace_front(Args&&... args);
+
+  template <typename... Args>
+  constexpr void emplace(iterator insert_it, Args&&... args);
+
+  constexpr void pop_front();
+
+  template <typename OutputIt>
+  constexpr OutputIt pop_front_n(size_t count, OutputIt out_it);
+  template <typename OutputIt>
+  constexpr OutputIt pop_back_n(size_t count, OutputIt out_it);
+
+  constexpr T& top();
+
+  constexpr const T& top() const;
+
+  constexpr T& operator[](size_t ind) noexcept;
+  constexpr const T& operator[](size_t ind) const noexcept;
+
+  constexpr T& at(size_t ind);
+  constexpr const T& at(size_t ind) const;
+
+  constexpr void insert(iterator insert_it, const T& value);
+  constexpr void insert(iterator insert_it, T&& value);
+  constexpr void erase(iterator erase_it);
+
+  constexpr void clear();
+  constexpr void swap(StaticDeque<T, N>& deq) noexcept(
+      std::is_nothrow_move_constructible_v<T> &&
+      std::is_nothrow_swappable_v<T>);
+
+ private:
+  union Slot {
+    constexpr Slot() : empty_() {}
+    constexpr ~Slot() {}
+
+    char empty_;
+    T value;
+  };
+
+  Slot data_[N];
+  size_t begin_ = 0;
+  size_t size_ = 0;
+
+  constexpr size_t physical(size_t ind) const;
+  constexpr T* slot(size_t ind);
+  constexpr const T* slot(size_t ind) const;
+  constexpr void check_capacity() const;
+};
+
+template <typename T, size_t N>
+template <bool IsConst>
+class StaticDeque<T, N>::BaseIterator {
+ public:
+  using value_type = T;
+  using reference = std::conditional_t<IsConst, const T&, T&>;
+  using pointer = std::conditional_t<IsConst, const T*, T*>;
+  using container_pointer =
+      std::conditional_t<IsConst, const StaticDeque*, StaticDeque*>;
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+
+  constexpr BaseIterator(size_t ind, container_pointer deq)
+      : ind_(ind), deq_(deq) {}
+  constexpr BaseIterator() : ind_(0), deq_(nullptr) {};
+  constexpr BaseIterator(const BaseIterator& iter) = default;
+  constexpr BaseIterator& operator=(const BaseIterator& iter) = default;
+
+  constexpr operator BaseIterator<true>() const { return {ind_, deq_}; }
+
+  template <bool Const>
+  constexpr difference_type operator-(const BaseIterator<Const>& iter) const {
+    return static_cast<difference_type>(ind_) -
+           static_cast<difference_type>(iter.get_ind());
+  }
+
+  template <bool Const>
+  constexpr bool operator>(const BaseIterator<Const>& iter) const {
+    return ind_ > iter.get_ind();
+  }
+  template <bool Const>
+  constexpr bool operator<(const BaseIterator<Const>& iter) const {
+    return ind_ < iter.get_ind();
+  }
+  template <bool Const>
+  constexpr bool operator>=(const BaseIterator<Const>& iter) const {
+    return !(*this < iter);
+  }
+  template <bool Const>
+  constexpr bool operator<=(const BaseIterator<Const>& iter) const {
+    return !(*this > iter);
+  }
+  template <bool Const>
+  constexpr bool operator==(const BaseIterator<Const>& iter) const {
+    return ind_ == iter.get_ind() && deq_ == iter.get_deq();
+  }
+  template <bool Const>
+  constexpr bool operator!=(const BaseIterator<Const>& iter) const {
+    return !(*this == iter);
+  }
+
+  constexpr BaseIterator& operator++() {
+    ++ind_;
+    return *this;
+  }
+  constexpr BaseIterator operator++(int) {
+    BaseIterator old_it = *this;
+    ++ind_;
+    return old_it;
+  }
+  constexpr BaseIterator& operator--() {
+    --ind_;
+    return *this;
+  }
+  constexpr BaseIterator operator--(int) {
+    BaseIterator old_it = *this;
+    --ind_;
+    return old_it;
+  }
+
+  constexpr BaseIterator& operator+=(int diff) {
+    ind_ += diff;
+    return *this;
+  }
+  constexpr BaseIterator& operator-=(int diff) { return *this += (-diff); }
+  constexpr BaseIterator operator+(int diff) const {
+    return {ind_ + diff, deq_};
+  }
+  constexpr BaseIterator operator-(int diff) const {
+    return {ind_ - diff, deq_};
+  }
+
+  constexpr pointer operator->() const { return deq_->slot(ind_); }
+  constexpr reference operator*() const { return *deq_->slot(ind_); }
+
+  constexpr container_pointer get_deq() const { return deq_; }
+  constexpr size_t get_ind() const { return ind_; }
+
+ private:
+  size_t ind_;
+  container_pointer deq_;
+};
+
+template <typename T, size_t N>
+constexpr size_t StaticDeque<T, N>::physical(size_t ind) const {
+  size_t pos = begin_ + ind;
+  return pos < N ? pos : pos - N;
+}
+
+template <typename T, size_t N>
+constexpr T* StaticDeque<T, N>::slot(size_t ind) {
+  return &data_[physical(ind)].value;
+}
+
+template <typename T, size_t N>
+constexpr const T* StaticDeque<T, N>::slot(size_t ind) const {
+  return &data_[physical(ind)].value;
+}
+
+template <typename T, size_t N>
+constexpr void StaticDeque<T, N>::check_capacity() const {
+  if (size_ == N) {
+    throw std::length_error("StaticDeque is full");
+  }
+}
+
+template <typename T, size_t N>
+constexpr StaticDeque<T, N>::StaticDeque(const StaticDeque& deq) {
+  try {
+    for (size_t ind = 0; ind < deq.size_; ++ind) {
+      emplace_back(deq[ind]);
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+template <typename T, size_t N>
+constexpr StaticDeque<T, N>::StaticDeque(size_t count) {
+  try {
+    for (size_t total_count = 0; total_count < count; ++total_count) {
+      emplace_back();
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+template <typename T, size_t N>
+constexpr StaticDeque<T, N>::StaticDeque(size_t count, const T& value) {
+  try {
+    for (size_t total_count = 0; total_count < count; ++total_count) {
+      emplace_back(value);
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+template <typename T, size_t N>
+constexpr StaticDeque<T, N>::StaticDeque(StaticDeque&& other) noexcept(
+    std::is_nothrow_move_constructible_v<T>) {
+  if constexpr (std::is_nothrow_move_constructible_v<T>) {
+    for (size_t ind = 0; ind < other.size_; ++ind) {
+      emplace_back(std::move(other[ind]));
+    }
+  } else {
+    try {
+      for (size_t ind = 0; ind < other.size_; ++ind) {
+        emplace_back(std::move(other[ind]));
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+  other.clear();
+}
+
+template <typename T, size_t N>
+constexpr StaticDeque<T, N>::StaticDeque(std::initializer_list<T> init) {
+  try {
+    for (auto iter = init.begin(); iter != init.end(); ++iter) {
+      emplace_back(*iter);
+    }
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+template <typename T, size_t N>
+constexpr StaticDeque<T, N>::~StaticDeque() {
+  clear();
+}
+
+template <typename T, size_t N>
+constexpr StaticDeque<T, N>& StaticDeque<T, N>::operator=(
+    const StaticDeque& deq) {
+  if (this != &deq) {
+    StaticDeque new_deq(deq);
+    swap(new_deq);
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+constexpr StaticDeque<T, N>& StaticDeque<T, N>::operator=(
+    StaticDeque&& deq) noexcept(std::is_nothrow_move_constructible_v<T>) {
+  if (this != &deq) {
+    clear();
+    for (size_t ind = 0; ind < deq.size_; ++ind) {
+      emplace_back(std::move(deq[ind]));
+    }
+    deq.clear();
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+constexpr void StaticDeque<T, N>::clear() {
+  while (!empty()) {
+    pop_back();
+  }
+  begin_ = 0;
+}
+
+template <typename T, size_t N>
+constexpr void StaticDeque<T, N>::swap(StaticDeque<T, N>& deq) noexcept(
+    std::is_nothrow_move_constructible_v<T> &&
+    std::is_nothrow_swappable_v<T>) {
+  if (this == &deq) {
+    return;
+  }
+  StaticDeque& shorter = size_ < deq.size_ ? *this : deq;
+  StaticDeque& longer = size_ < deq.size_ ? deq : *this;
+  size_t common = shorter.size_;
+  for (size_t ind = 0; ind < common; ++ind) {
+    using std::swap;
+    swap(*slot(ind), *deq.slot(ind));
+  }
+  for (size_t ind = common; ind < longer.size_; ++ind) {
+    shorter.emplace_back(std::move(*longer.slot(ind)));
+  }
+  while (longer.size_ > common) {
+    longer.pop_back();
+  }
+}
+
+template <typename T, size_t N>
+constexpr T& StaticDeque<T, N>::operator[](size_t ind) noexcept {
+  return *slot(ind);
+}
+
+template <typename T, size_t N>
+constexpr const T& StaticDeque<T, N>::operator[](size_t ind) const noexcept {
+  return *slot(ind);
+}
+
+template <typename T, size_t N>
+constexpr T& StaticDeque<T, N>::at(size_t ind) {
+  if (ind >= size_) {
+    throw std::out_of_range("out of range");
+  }
+  return *slot(ind);
+}
+
+template <typename T, size_t N>
+constexpr const T& StaticDeque<T, N>::at(size_t ind) const {
+  if (ind >= size_) {
+    throw std::out_of_range("out of range");
+  }
+  return *slot(ind);
+}
+
+template <typename T, size_t N>
+constexpr void StaticDeque<T, N>::push_back(const T& value) {
+  emplace_back(value);
+}
+
+template <typename T, size_t N>
+constexpr void StaticDeque<T, N>::push_back(T&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+constexpr void StaticDeque<T, N>::emplace_back(Args&&... args) {
+  check_capacity();
+  std::construct_at(slot(size_), std::forward<Args>(args)...);
+  ++size_;
+}
+
+template <typename T, size_t N>
+constexpr void StaticDeque<T, N>::push_front(const T& value) {
+  emplace_front(value);
+}
+
+template <typename T, size_t N>
+constexpr void StaticDeque<T, N>::push_front(T&& value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+constexpr void StaticDeque<T, N>::emplace_front(Args&&... args) {
+  check_capacity();
+  size_t new_begin = begin_ == 0 ? N - 1 : begin_ - 1;
+  std::construct_at(&data_[new_begin].value, std::forward<Args>(args)...);
+  begin_ = new_begin;
+  ++size_;
+}
+
+template <typename T, size_t N>
+constexpr void StaticDeque<T, N>::pop_back() {
+  assert(size_ > 0);
+  --size_;
+  std::destroy_at(slot(size_));
+}
+
+template <typename T, size_t N>
+constexpr void StaticDeque<T, N>::pop_front() {
+  assert(size_ > 0);
+  std::destroy_at(slot(0));
+  begin_ = physical(1);
+  --size_;
+}
+
+template <typename T, size_t N>
+template <typename OutputIt>
+constexpr OutputIt StaticDeque<T, N>::pop_front_n(size_t count,
+                                                  OutputIt out_it) {
+  assert(count <= size_);
+  for (; count > 0; --count) {
+    *out_it = std::move(*slot(0));
+    ++out_it;
+    pop_front();
+  }
+  return out_it;
+}
+
+template <typename T, size_t N>
+template <typename OutputIt>
+constexpr OutputIt StaticDeque<T, N>::pop_back_n(size_t count,
+                                                 OutputIt out_it) {
+  assert(count <= size_);
+  for (; count > 0; --count) {
+    *out_it = std::move(*slot(size_ - 1));
+    ++out_it;
+    pop_back();
+  }
+  return out_it;
+}
+
+template <typename T, size_t N>
+constexpr T& StaticDeque<T, N>::top() {
+  return *slot(size_ - 1);
+}
+
+template <typename T, size_t N>
+constexpr const T& StaticDeque<T, N>::top() const {
+  return *slot(size_ - 1);
+}
+
+template <typename T, size_t N>
+constexpr void StaticDeque<T, N>::insert(iterator insert_it, const T& value) {
+  emplace(insert_it, value);
+}
+
+template <typename T, size_t N>
+constexpr void StaticDeque<T, N>::insert(iterator insert_it, T&& value) {
+  emplace(insert_it, std::move(value));
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+constexpr void StaticDeque<T, N>::emplace(iterator insert_it,
+                                          Args&&... args) {
+  if (insert_it == begin()) {
+    emplace_front(std::forward<Args>(args)...);
+    return;
+  }
+  if (insert_it == end()) {
+    emplace_back(std::forward<Args>(args)...);
+    return;
+  }
+  T value(std::forward<Args>(args)...);
+  emplace_back(std::move(top()));
+  std::move_backward(insert_it, end() - 2, end() - 1);
+  *insert_it = std::move(value);
+}
+
+template <typename T, size_t N>
+constexpr void StaticDeque<T, N>::erase(iterator erase_it) {
+  std::move(erase_it + 1, end(), erase_it);
+  pop_back();
+}